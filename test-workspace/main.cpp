@@ -17,9 +17,10 @@
 #ifdef ESP32
 #include "tasks/gps_task.h" // GPS task for ESP32
 #else
-#include <chrono>   // For timing in simulator
-#include <unistd.h> // For usleep in simulator
+#include <thread> // For sleep_until in simulator main loop
 #endif
+#include <algorithm> // For std::min/std::max
+#include <chrono>    // For simulator timing and native startup stage timing
 #include "logging.h"
 #include "ui/ui.h"
 
@@ -47,6 +48,33 @@ void demo_nearest_location();
 void demo_location_bearing();
 void demo_gps_data();
 
+// --- Startup stage timing ---
+static unsigned long stage_begin_ms = 0;
+
+// Milliseconds since boot on ARDUINO; since the first call (start of setup()) on native
+static unsigned long elapsed_ms()
+{
+#ifdef ARDUINO
+    return millis();
+#else
+    static const auto origin = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - origin)
+        .count();
+#endif
+}
+
+// Log how long the stage that just finished took, then start timing the next one
+static void stage_done(const char *stage)
+{
+    unsigned long now = elapsed_ms();
+    char message[100];
+    snprintf(message, sizeof(message), "Stage '%s' took %lu ms (total %lu ms)", stage,
+             now - stage_begin_ms, now);
+    log_info(message);
+    stage_begin_ms = now;
+}
+
 // ESP_IOExpander_CH422G *expander;
 
 // void BLset(byte state) { expander->digitalWrite(LCD_BL, state); }
@@ -81,6 +109,8 @@ void demo_gps_data();
 
 void setup()
 {
+    stage_begin_ms = elapsed_ms();
+
 #ifdef ARDUINO                                   // Ensure Serial is available
     Serial.begin(115200);                        // Initialize Serial at the expected baud rate
     delay(1000);                                 // Wait a moment for serial connection to establish
@@ -121,6 +151,7 @@ void setup()
     log_info("WAVESHARE45_DEVICE is NOT defined");
 #endif
     log_info("--- End Flag Check ---");
+    stage_done("serial_and_logging");
 
 #ifdef T5EPAPER_DEVICE
     // Specific setup for T5 E-Paper
@@ -132,6 +163,7 @@ void setup()
     log_info("DEBUG-2: Initializing GPS cache");
     gps_cache_init();
     log_info("DEBUG-3: GPS cache initialized");
+    stage_done("gps_cache_init");
 
 #ifdef ARDUINO
     // vTaskDelay(pdMS_TO_TICKS(2000));
@@ -141,6 +173,7 @@ void setup()
     // try to read a i2c device at 0x5D
     Wire.begin(I2C_MASTER_SDA_IO, I2C_MASTER_SCL_IO);
     log_info("DEBUG-5: I2C initialized");
+    stage_done("i2c");
     // Wire.beginTransmission(93);
     // if (Wire.endTransmission() == 0) {
     //   log_info("I2C device found at 0x5D");
@@ -166,6 +199,7 @@ void setup()
     gps_task_start();
     log_info("DEBUG-9: GPS task started");
 #endif
+    stage_done("gps_hal");
 
     // Example of loading version.txt file using the filesystem abstraction
     log_info("DEBUG-10: Loading version information");
@@ -188,6 +222,7 @@ void setup()
     {
         log_error("WaveShare45 SD card test failed");
     }
+    stage_done("sd_card");
 #endif
 
 #ifdef ARDUINO
@@ -213,6 +248,7 @@ void setup()
         log_error("Failed to read version.txt");
     }
 #endif
+    stage_done("version");
 
     // Initialize Display HAL and UI for all relevant devices
     log_info("DEBUG-12: Starting display HAL initialization...");
@@ -241,10 +277,12 @@ void setup()
 #endif
     }
     log_info("DEBUG-16: Display HAL initialized successfully");
+    stage_done("display_hal");
 
     log_info("DEBUG-17: Starting UI initialization...");
     ui_init();
     log_info("DEBUG-18: UI initialized successfully");
+    stage_done("ui_init");
     // End of removed conditional block
 
     log_info("DEBUG-19: Setup complete");
@@ -254,9 +292,9 @@ void setup()
     {
         char message[100];
         log_info("Conversion successful");
-        sprintf(message, "Input value: %.2f", response.results[0].inputValue);
+        snprintf(message, sizeof(message), "Input value: %.2f", response.results[0].inputValue);
         log_info(message);
-        sprintf(message, "Output value: %.2f", response.results[0].outputValue);
+        snprintf(message, sizeof(message), "Output value: %.2f", response.results[0].outputValue);
         log_info(message);
     }
     else
@@ -267,6 +305,7 @@ void setup()
     std::string result = UnitConverter::parseAndConvertToString("5km to ");
     log_info("Conversion as string:");
     log_info(result.c_str());
+    stage_done("unit_converter");
 
     // Example of finding a location by name using the LocationsManager
     log_info("Searching for location: jump");
@@ -274,6 +313,7 @@ void setup()
     // Initialize locations from CSV file
     log_info("Initializing locations from CSV file");
     initLocationsData();
+    stage_done("locations_data");
 
     // Get the LocationsManager instance
     LocationsManager &locManager = LocationsManager::GetInstance();
@@ -286,13 +326,13 @@ void setup()
     {
         log_info("Found locations starting with 'J':");
         char debug_msg[100];
-        sprintf(debug_msg, "Found %zu locations", locations_j.size());
+        snprintf(debug_msg, sizeof(debug_msg), "Found %zu locations", locations_j.size());
         log_info(debug_msg);
 
         // Display first few matches
         for (size_t i = 0; i < std::min(size_t(3), locations_j.size()); ++i)
         {
-            sprintf(debug_msg, "%zu. %s (%s)", i + 1, locations_j[i]->name, locations_j[i]->code);
+            snprintf(debug_msg, sizeof(debug_msg), "%zu. %s (%s)", i + 1, locations_j[i]->name, locations_j[i]->code);
             log_info(debug_msg);
         }
     }
@@ -307,13 +347,13 @@ void setup()
     {
         log_info("Found locations starting with 'JP':");
         char debug_msg[100];
-        sprintf(debug_msg, "Found %zu locations", locations_jp.size());
+        snprintf(debug_msg, sizeof(debug_msg), "Found %zu locations", locations_jp.size());
         log_info(debug_msg);
 
         // Display first few matches
         for (size_t i = 0; i < std::min(size_t(3), locations_jp.size()); ++i)
         {
-            sprintf(debug_msg, "%zu. %s (%s)", i + 1, locations_jp[i]->name, locations_jp[i]->code);
+            snprintf(debug_msg, sizeof(debug_msg), "%zu. %s (%s)", i + 1, locations_jp[i]->name, locations_jp[i]->code);
             log_info(debug_msg);
         }
     }
@@ -328,13 +368,13 @@ void setup()
     {
         log_info("Found locations starting with 'JPP':");
         char debug_msg[100];
-        sprintf(debug_msg, "Found %zu locations", locations_jpp.size());
+        snprintf(debug_msg, sizeof(debug_msg), "Found %zu locations", locations_jpp.size());
         log_info(debug_msg);
 
         // Display all matches (likely only a few for a specific code like JPP)
         for (size_t i = 0; i < locations_jpp.size(); ++i)
         {
-            sprintf(debug_msg, "%zu. %s (%s)", i + 1, locations_jpp[i]->name, locations_jpp[i]->code);
+            snprintf(debug_msg, sizeof(debug_msg), "%zu. %s (%s)", i + 1, locations_jpp[i]->name, locations_jpp[i]->code);
             log_info(debug_msg);
         }
     }
@@ -351,8 +391,8 @@ void setup()
         if (locations_vfr[i].name != nullptr)
         {
             char debug_msg[100];
-            sprintf(debug_msg, "Location %zu: %s (Code: %s)", i,
-                    locations_vfr[i].name, locations_vfr[i].code);
+            snprintf(debug_msg, sizeof(debug_msg), "Location %zu: %s (Code: %s)", i,
+                     locations_vfr[i].name, locations_vfr[i].code);
             log_info(debug_msg);
         }
     }
@@ -364,7 +404,7 @@ void setup()
     {
         log_info("Locations found:");
         char message[100];
-        sprintf(message, "Found %zu locations matching 'jpp'", locations.size());
+        snprintf(message, sizeof(message), "Found %zu locations matching 'jpp'", locations.size());
         log_info(message);
 
         // Display details for each location found
@@ -372,24 +412,24 @@ void setup()
         {
             Location *location = locations[i];
             log_info("---------------------------------");
-            sprintf(message, "Location %zu:", i + 1);
+            snprintf(message, sizeof(message), "Location %zu:", i + 1);
             log_info(message);
-            sprintf(message, "Name: %s", location->name);
+            snprintf(message, sizeof(message), "Name: %s", location->name);
             log_info(message);
-            sprintf(message, "State: %s", location->state ? location->state : "N/A");
+            snprintf(message, sizeof(message), "State: %s", location->state ? location->state : "N/A");
             log_info(message);
-            sprintf(message, "Code: %s", location->code);
+            snprintf(message, sizeof(message), "Code: %s", location->code);
             log_info(message);
 
             // Use the new FormatCoordinates method
             std::string coordStr = locManager.FormatCoordinates(location);
-            sprintf(message, "Coordinates: %s", coordStr.c_str());
+            snprintf(message, sizeof(message), "Coordinates: %s", coordStr.c_str());
             log_info(message);
 
             // Also show DMS format
             std::string dmsCoords =
                 locManager.FormatCoordinates(location, CoordinateFormat::DMS);
-            sprintf(message, "Coordinates (DMS): %s", dmsCoords.c_str());
+            snprintf(message, sizeof(message), "Coordinates (DMS): %s", dmsCoords.c_str());
             log_info(message);
         }
     }
@@ -407,10 +447,10 @@ void setup()
 
     char debug_msg[100];
     log_debug("Converting DMS: 274400S");
-    sprintf(debug_msg, "Decimal latitude: %.6f", lat);
+    snprintf(debug_msg, sizeof(debug_msg), "Decimal latitude: %.6f", lat);
     log_debug(debug_msg);
     log_debug("Converting DMS: 1532700E");
-    sprintf(debug_msg, "Decimal longitude: %.6f", lon);
+    snprintf(debug_msg, sizeof(debug_msg), "Decimal longitude: %.6f", lon);
     log_debug(debug_msg);
 
     // Find the nearest location to these coordinates
@@ -420,22 +460,22 @@ void setup()
     {
         char message[100];
         log_info("Nearest location found:");
-        sprintf(message, "Name: %s", nearest->name);
+        snprintf(message, sizeof(message), "Name: %s", nearest->name);
         log_info(message);
-        sprintf(message, "State: %s", nearest->state);
+        snprintf(message, sizeof(message), "State: %s", nearest->state);
         log_info(message);
-        sprintf(message, "Code: %s", nearest->code);
+        snprintf(message, sizeof(message), "Code: %s", nearest->code);
         log_info(message);
 
         // Show the coordinates
         std::string coordStr = locManager.FormatCoordinates(nearest);
-        sprintf(message, "Coordinates: %s", coordStr.c_str());
+        snprintf(message, sizeof(message), "Coordinates: %s", coordStr.c_str());
         log_info(message);
 
         // Calculate and display the distance
         double distance = locManager.CalculateDistance(lat, lon, nearest->latitude,
                                                        nearest->longitude);
-        sprintf(message, "Distance: %.2f km", distance);
+        snprintf(message, sizeof(message), "Distance: %.2f km", distance);
         log_info(message);
     }
     else
@@ -450,7 +490,7 @@ void setup()
     if (!nearestLocations.empty())
     {
         char message[100];
-        sprintf(message, "Found %zu nearest locations:", nearestLocations.size());
+        snprintf(message, sizeof(message), "Found %zu nearest locations:", nearestLocations.size());
         log_info(message);
 
         // Display each location and its distance
@@ -460,18 +500,18 @@ void setup()
             double dist = locManager.CalculateDistance(lat, lon, loc->latitude, loc->longitude);
 
             log_info("-------------------------");
-            sprintf(message, "%zu. Name: %s", i + 1, loc->name);
+            snprintf(message, sizeof(message), "%zu. Name: %s", i + 1, loc->name);
             log_info(message);
-            sprintf(message, "   Code: %s", loc->code);
+            snprintf(message, sizeof(message), "   Code: %s", loc->code);
             log_info(message);
-            sprintf(message, "   State: %s", loc->state ? loc->state : "N/A");
+            snprintf(message, sizeof(message), "   State: %s", loc->state ? loc->state : "N/A");
             log_info(message);
-            sprintf(message, "   Distance: %.2f km", dist);
+            snprintf(message, sizeof(message), "   Distance: %.2f km", dist);
             log_info(message);
 
             // Show the coordinates
             std::string coordStr = locManager.FormatCoordinates(loc);
-            sprintf(message, "   Coordinates: %s", coordStr.c_str());
+            snprintf(message, sizeof(message), "   Coordinates: %s", coordStr.c_str());
             log_info(message);
         }
     }
@@ -487,6 +527,7 @@ void setup()
     // Test Demo for bearing calculation
     log_info("Testing bearing calculation demo");
     demo_location_bearing();
+    stage_done("demo_searches");
 
 #ifndef ARDUINO
     // Removed premature return for native build to allow main loop execution
@@ -519,25 +560,25 @@ void demo_nearest_location()
     {
         char message[100];
         log_info("Nearest location found:");
-        sprintf(message, "Name: %s", nearest->name);
+        snprintf(message, sizeof(message), "Name: %s", nearest->name);
         log_info(message);
-        sprintf(message, "Code: %s", nearest->code);
+        snprintf(message, sizeof(message), "Code: %s", nearest->code);
         log_info(message);
         if (nearest->state)
         {
-            sprintf(message, "State: %s", nearest->state);
+            snprintf(message, sizeof(message), "State: %s", nearest->state);
             log_info(message);
         }
 
         // Calculate and show distance
         double distance = locMgr.CalculateDistance(testLat, testLon,
                                                    nearest->latitude, nearest->longitude);
-        sprintf(message, "Distance: %.2f km", distance);
+        snprintf(message, sizeof(message), "Distance: %.2f km", distance);
         log_info(message);
 
         // Show coordinates
         std::string coordStr = locMgr.FormatCoordinates(nearest);
-        sprintf(message, "Coordinates: %s", coordStr.c_str());
+        snprintf(message, sizeof(message), "Coordinates: %s", coordStr.c_str());
         log_info(message);
     }
     else
@@ -564,20 +605,20 @@ void demo_location_bearing()
     double brisbane_lon = 153.0251; // Corrected for proper East longitude
 
     char message[100];
-    sprintf(message, "Using Sydney at %.4f, %.4f", sydney_lat, sydney_lon);
+    snprintf(message, sizeof(message), "Using Sydney at %.4f, %.4f", sydney_lat, sydney_lon);
     log_info(message);
 
-    sprintf(message, "Using Brisbane at %.4f, %.4f", brisbane_lat, brisbane_lon);
+    snprintf(message, sizeof(message), "Using Brisbane at %.4f, %.4f", brisbane_lat, brisbane_lon);
     log_info(message);
 
     // Calculate bearing from Sydney to Brisbane
     double bearing = locMgr.CalculateBearing(sydney_lat, sydney_lon, brisbane_lat, brisbane_lon);
-    sprintf(message, "Bearing from Sydney to Brisbane: %.1f degrees", bearing);
+    snprintf(message, sizeof(message), "Bearing from Sydney to Brisbane: %.1f degrees", bearing);
     log_info(message);
 
     // Also calculate distance
     double distance = locMgr.CalculateDistance(sydney_lat, sydney_lon, brisbane_lat, brisbane_lon);
-    sprintf(message, "Distance from Sydney to Brisbane: %.1f km", distance);
+    snprintf(message, sizeof(message), "Distance from Sydney to Brisbane: %.1f km", distance);
     log_info(message);
 
     demo_gps_data();
@@ -596,19 +637,19 @@ void demo_gps_data()
 
     log_info("Current GPS Position:");
 
-    sprintf(buffer, "  Latitude:  %.6f", gps.getLatitude());
+    snprintf(buffer, sizeof(buffer), "  Latitude:  %.6f", gps.getLatitude());
     log_info(buffer);
 
-    sprintf(buffer, "  Longitude: %.6f", gps.getLongitude());
+    snprintf(buffer, sizeof(buffer), "  Longitude: %.6f", gps.getLongitude());
     log_info(buffer);
 
-    sprintf(buffer, "  Altitude:  %.1f meters", gps.getAltitude());
+    snprintf(buffer, sizeof(buffer), "  Altitude:  %.1f meters", gps.getAltitude());
     log_info(buffer);
 
-    sprintf(buffer, "  Ground Speed: %.1f knots", gps.getGroundSpeed());
+    snprintf(buffer, sizeof(buffer), "  Ground Speed: %.1f knots", gps.getGroundSpeed());
     log_info(buffer);
 
-    sprintf(buffer, "  Heading: %.1f degrees", gps.getHeading());
+    snprintf(buffer, sizeof(buffer), "  Heading: %.1f degrees", gps.getHeading());
     log_info(buffer);
 }
 
@@ -616,6 +657,7 @@ void demo_gps_data()
 #ifndef ESP32
 static auto last_gps_poll_time = std::chrono::steady_clock::now();
 const auto gps_poll_interval = std::chrono::milliseconds(10000); // 10 seconds
+const auto display_tick_interval = std::chrono::milliseconds(5);  // LVGL tick period
 
 void poll_gps_and_update_cache()
 {
@@ -672,6 +714,14 @@ void loop()
 #endif
     DisplayHAL::getInstance().update();
 
+    // The first update() is the first frame actually drawn
+    static bool first_frame_done = false;
+    if (!first_frame_done)
+    {
+        first_frame_done = true;
+        stage_done("first_frame");
+    }
+
     // lv_tick_inc is handled within DisplayHAL::update() for native builds
     // lv_tick_inc(5); // Removed redundant call
 
@@ -697,11 +747,92 @@ void loop()
 int main(int argc, char *argv[])
 {
     setup();
+
+#ifndef ESP32
+    // Loop timing stats, reported once per window of iterations:
+    // - period: time between iteration starts; jitter is max - min
+    // - overrun: loop() ran past its deadline, so there was nothing to sleep
+    // - oversleep: how late we woke up after actually sleeping
+    using micros = std::chrono::microseconds;
+    const uint32_t stats_window = 1000;
+    uint32_t iterations = 0;
+    uint32_t overruns = 0;
+    micros min_period = micros::max();
+    micros max_period{0};
+    micros max_overrun{0};
+    micros total_oversleep{0};
+    micros max_oversleep{0};
+    bool have_prev_frame = false;
+    auto prev_frame_start = std::chrono::steady_clock::now();
+#endif
+
     while (true)
     {
+#ifndef ESP32
+        auto frame_start = std::chrono::steady_clock::now();
+        if (have_prev_frame)
+        {
+            auto period = std::chrono::duration_cast<micros>(frame_start - prev_frame_start);
+            min_period = std::min(min_period, period);
+            max_period = std::max(max_period, period);
+        }
+        prev_frame_start = frame_start;
+        have_prev_frame = true;
+#endif
+
         loop();
-        // DisplayHAL::update() already includes a small delay, so extra sleep is removed.
-        // usleep(10000); // Removed redundant delay
+
+#ifndef ESP32
+        // Sleep until the next display tick or GPS poll instead of spinning.
+        // DisplayHAL::update() may already include a small delay. The deadline
+        // is measured from the start of the iteration, so that delay counts
+        // towards the tick and we only sleep for whatever is left of it. If
+        // update() uses the whole tick, we do not sleep at all and the
+        // iteration shows up as an overrun in the stats below.
+        auto deadline = std::min(frame_start + display_tick_interval,
+                                 last_gps_poll_time + gps_poll_interval);
+        auto loop_end = std::chrono::steady_clock::now();
+        if (loop_end < deadline)
+        {
+            std::this_thread::sleep_until(deadline);
+            auto oversleep = std::chrono::duration_cast<micros>(
+                std::chrono::steady_clock::now() - deadline);
+            total_oversleep += oversleep;
+            max_oversleep = std::max(max_oversleep, oversleep);
+        }
+        else
+        {
+            overruns++;
+            max_overrun = std::max(max_overrun,
+                                   std::chrono::duration_cast<micros>(loop_end - deadline));
+        }
+
+        if (++iterations == stats_window)
+        {
+            uint32_t slept = iterations - overruns;
+            char message[100];
+            snprintf(message, sizeof(message),
+                     "Loop period: min %lld us, max %lld us, jitter %lld us",
+                     static_cast<long long>(min_period.count()),
+                     static_cast<long long>(max_period.count()),
+                     static_cast<long long>((max_period - min_period).count()));
+            log_debug(message);
+            snprintf(message, sizeof(message),
+                     "Loop overruns: %u (max %lld us), oversleep avg %lld us, max %lld us",
+                     static_cast<unsigned>(overruns),
+                     static_cast<long long>(max_overrun.count()),
+                     static_cast<long long>(slept ? total_oversleep.count() / slept : 0),
+                     static_cast<long long>(max_oversleep.count()));
+            log_debug(message);
+            iterations = 0;
+            overruns = 0;
+            min_period = micros::max();
+            max_period = micros{0};
+            max_overrun = micros{0};
+            total_oversleep = micros{0};
+            max_oversleep = micros{0};
+        }
+#endif
     }
     return 0;
 }